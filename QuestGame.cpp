@@ -6,7 +6,30 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <string>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <set>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <deque>
+#include <condition_variable>
+#include <numeric>
+#include <cctype>
+#include <iterator>
+#include <cstdio>
+#include <array>
+#include <cmath>
 #include <SFML/Audio.hpp>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
 
 // GAME STATE ENUM
 enum class GameState {
@@ -15,7 +38,8 @@ enum class GameState {
     QUIZ,
     CREDITS,
     HELP,
-    COMPLETE
+    COMPLETE,
+    BROWSER
 };
 
 // FEEDBACK VARIABLES
@@ -56,8 +80,940 @@ struct Question {
     int score = 0;
 };
 
+// UTF-8 TEXT DECODING (QUESTION STRINGS CONTAIN ’ AND OTHER NON-ASCII)
+sf::String toSfString(const std::string& utf8) {
+    return sf::String::fromUtf8(utf8.begin(), utf8.end());
+}
+
+// COLLECT EVERY CODE POINT THE QUESTION BANK CAN DISPLAY
+std::u32string collectCharset(const std::vector<Question>& questions, const std::vector<std::string>& extra) {
+    std::u32string charset;
+    auto addString = [&charset](const std::string& s) {
+        for (char32_t c : toSfString(s))
+            if (c != U'\n' && c != U'\r') charset.push_back(c);
+        };
+    for (const Question& q : questions) {
+        addString(q.text);
+        for (const std::string& a : q.answers) addString(a);
+    }
+    for (const std::string& s : extra) addString(s);
+
+    std::sort(charset.begin(), charset.end());
+    charset.erase(std::unique(charset.begin(), charset.end()), charset.end());
+    return charset;
+}
+
+// GLYPH PREWARMING - RASTERIZE AT LOAD TIME INSTEAD OF MID-QUIZ
+void prewarmGlyphs(const sf::Font& font, const std::u32string& charset, const std::vector<unsigned int>& sizes) {
+    for (unsigned int size : sizes)
+        for (char32_t c : charset)
+            font.getGlyph(c, size, false);
+}
+
+// TEXT SIZES AND FIXED UI STRINGS (PREWARMED TOGETHER WITH THE QUESTION BANK)
+const std::vector<unsigned int> textSizes = { 35, 45, 50, 60 };
+const std::vector<std::string> uiStrings = {
+    "0123456789:", "You scored  points",
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"    // GENERATED PUZZLES, BROWSER SEARCH
+};
+
+// QUESTION BANK FILE
+const std::string assetDir = "assets";
+const std::string questionFile = assetDir + "/questions.txt";
+
+// QUESTION FILE LOADER - BLOCKS OF TEXT LINE, ANSWERS LINE (EXACTLY A|B|C|D), CORRECT INDEX LINE (0-3)
+bool loadQuestionFile(const std::string& path, std::vector<Question>& out) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::vector<Question> questions;
+    std::vector<std::string> block;
+    std::string line;
+    auto finishBlock = [&questions, &block, &path]() {
+        if (block.empty()) return true;
+        if (block.size() != 3) {
+            std::cerr << path << ": question block needs 3 lines\n";
+            return false;
+        }
+        Question q;
+        for (std::size_t i = 0; i < block[0].size(); i++) {
+            if (block[0][i] == '\\' && i + 1 < block[0].size() && block[0][i + 1] == 'n') {
+                q.text += '\n';
+                i++;
+            }
+            else q.text += block[0][i];
+        }
+        std::size_t from = 0, bar;
+        while ((bar = block[1].find('|', from)) != std::string::npos) {
+            q.answers.push_back(block[1].substr(from, bar - from));
+            from = bar + 1;
+        }
+        q.answers.push_back(block[1].substr(from));
+        if (q.answers.size() != 4) {
+            std::cerr << path << ": need exactly 4 answers \"" << block[1] << "\"\n";
+            return false;
+        }
+        try { q.correctIndex = std::stoi(block[2]); }
+        catch (...) { q.correctIndex = -1; }
+        if (q.correctIndex < 0 || q.correctIndex > 3) {
+            std::cerr << path << ": bad correct index \"" << block[2] << "\"\n";
+            return false;
+        }
+        questions.push_back(q);
+        block.clear();
+        return true;
+        };
+
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty() && line[0] == '#') continue;
+        if (line.empty()) {
+            if (!finishBlock()) return false;
+        }
+        else block.push_back(line);
+    }
+    if (!finishBlock() || questions.empty()) return false;
+
+    out = std::move(questions);
+    return true;
+}
+
+// SEARCH INDEX - SPLITS TEXT INTO LOWERCASE ASCII WORDS (NON-ASCII BYTES SEPARATE WORDS)
+template <typename Callback>
+void forEachToken(const std::string& text, Callback callback) {
+    std::string token;
+    for (char c : text) {
+        unsigned char u = static_cast<unsigned char>(c);
+        if (u < 128 && std::isalnum(u)) token += static_cast<char>(std::tolower(u));
+        else if (!token.empty()) {
+            callback(token);
+            token.clear();
+        }
+    }
+    if (!token.empty()) callback(token);
+}
+
+// POSTING LISTS - SORTED QUESTION IDS STORED AS VARINT-ENCODED GAPS
+void appendPosting(std::vector<std::uint8_t>& bytes, int gap) {
+    std::uint32_t value = static_cast<std::uint32_t>(gap);
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+// DECODED IDS ARE APPENDED TO "ids"
+void decodePostings(const std::vector<std::uint8_t>& bytes, std::vector<int>& ids) {
+    std::uint32_t value = 0;
+    int shift = 0, last = 0;
+    for (std::uint8_t b : bytes) {
+        value |= static_cast<std::uint32_t>(b & 0x7F) << shift;
+        if (b & 0x80) {
+            shift += 7;
+            continue;
+        }
+        last += static_cast<int>(value);
+        ids.push_back(last);
+        value = 0;
+        shift = 0;
+    }
+}
+
+// INVERTED INDEX OVER QUESTION TEXT AND ANSWERS (IDS ARE POSITIONS IN THE QUESTION BANK)
+struct QuestionIndex {
+    std::vector<std::string> terms;
+    std::vector<std::vector<std::uint8_t>> postings;
+    std::vector<int> postingCounts;
+    int documents = 0;
+
+    // PARALLEL BUILD - EACH THREAD INDEXES A CONTIGUOUS SLICE, SLICES ARE MERGED IN ORDER
+    void build(const std::vector<Question>& questions) {
+        documents = static_cast<int>(questions.size());
+        int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        threads = std::max(1, std::min(threads, documents / 1024));
+        int slice = (documents + threads - 1) / threads;
+
+        std::vector<std::unordered_map<std::string, std::vector<int>>> partial(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&questions, &partial, t, slice, this]() {
+                auto& words = partial[t];
+                int end = std::min(documents, (t + 1) * slice);
+                for (int id = t * slice; id < end; id++) {
+                    auto add = [&words, id](const std::string& token) {
+                        std::vector<int>& ids = words[token];
+                        if (ids.empty() || ids.back() != id) ids.push_back(id);
+                        };
+                    forEachToken(questions[id].text, add);
+                    for (const std::string& a : questions[id].answers) forEachToken(a, add);
+                }
+                });
+        }
+        for (std::thread& w : workers) w.join();
+
+        std::unordered_map<std::string, std::pair<std::vector<std::uint8_t>, int>> merged;
+        for (auto& words : partial) {
+            for (auto& [term, ids] : words) {
+                auto& [bytes, last] = merged.try_emplace(term, std::vector<std::uint8_t>(), 0).first->second;
+                for (int id : ids) {
+                    appendPosting(bytes, id - last);
+                    last = id;
+                }
+            }
+            words.clear();
+        }
+
+        terms.clear();
+        postings.clear();
+        postingCounts.clear();
+        terms.reserve(merged.size());
+        postings.reserve(merged.size());
+        postingCounts.reserve(merged.size());
+        for (auto& [term, entry] : merged) terms.push_back(term);
+        std::sort(terms.begin(), terms.end());
+        for (const std::string& term : terms) {
+            std::vector<std::uint8_t>& bytes = merged[term].first;
+            postingCounts.push_back(static_cast<int>(std::count_if(bytes.begin(), bytes.end(),
+                [](std::uint8_t b) { return b < 0x80; })));
+            postings.push_back(std::move(bytes));
+        }
+    }
+
+    // IDS FOR ONE QUERY WORD, "word*" MATCHES EVERY TERM STARTING WITH "word"
+    std::vector<int> lookup(const std::string& word) const {
+        bool prefix = !word.empty() && word.back() == '*';
+        std::string key = prefix ? word.substr(0, word.size() - 1) : word;
+        std::vector<int> result;
+        auto first = std::lower_bound(terms.begin(), terms.end(), key);
+        if (!prefix) {
+            if (first != terms.end() && *first == key) decodePostings(postings[first - terms.begin()], result);
+            return result;
+        }
+
+		// PREFIX - FEW IDS ARE GATHERED AND SORTED, MANY ARE MARKED IN A BITMAP OVER THE BANK
+        auto last = first;
+        std::size_t total = 0;
+        for (; last != terms.end() && last->compare(0, key.size(), key) == 0; ++last)
+            total += postingCounts[last - terms.begin()];
+        if (last - first == 1) {
+            decodePostings(postings[first - terms.begin()], result);
+            return result;
+        }
+        if (total < static_cast<std::size_t>(documents) / 16) {
+            result.reserve(total);
+            for (auto it = first; it != last; ++it) decodePostings(postings[it - terms.begin()], result);
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            return result;
+        }
+        std::vector<bool> hit(documents, false);
+        std::vector<int> ids;
+        for (auto it = first; it != last; ++it) {
+            ids.clear();
+            decodePostings(postings[it - terms.begin()], ids);
+            for (int id : ids) hit[id] = true;
+        }
+        for (int id = 0; id < documents; id++)
+            if (hit[id]) result.push_back(id);
+        return result;
+    }
+
+    // BOOLEAN QUERY - WORDS ARE ANDED, "-word" EXCLUDES, "OR" SEPARATES ALTERNATIVES
+    std::vector<int> search(const std::string& query) const {
+        struct Group {
+            std::vector<std::string> include;
+            std::vector<std::string> exclude;
+        };
+        std::vector<Group> groups(1);
+        std::string word;
+        for (std::size_t i = 0; i <= query.size(); i++) {
+            if (i < query.size() && query[i] != ' ') {
+                word += query[i];
+                continue;
+            }
+            if (word == "OR") groups.emplace_back();
+            else if (!word.empty()) {
+                std::vector<std::string>& keys = word[0] == '-' ? groups.back().exclude : groups.back().include;
+                std::size_t before = keys.size();
+                forEachToken(word, [&keys](const std::string& token) { keys.push_back(token); });
+                if (word.back() == '*' && keys.size() > before) keys.back() += '*';
+            }
+            word.clear();
+        }
+
+        std::vector<int> result;
+        for (const Group& group : groups) {
+            if (group.include.empty()) continue;
+            std::vector<int> matches = lookup(group.include[0]);
+            for (std::size_t i = 1; i < group.include.size(); i++) {
+                std::vector<int> ids = lookup(group.include[i]), narrowed;
+                std::set_intersection(matches.begin(), matches.end(), ids.begin(), ids.end(), std::back_inserter(narrowed));
+                matches.swap(narrowed);
+            }
+            for (const std::string& key : group.exclude) {
+                std::vector<int> ids = lookup(key), kept;
+                std::set_difference(matches.begin(), matches.end(), ids.begin(), ids.end(), std::back_inserter(kept));
+                matches.swap(kept);
+            }
+            std::vector<int> joined;
+            std::set_union(result.begin(), result.end(), matches.begin(), matches.end(), std::back_inserter(joined));
+            result.swap(joined);
+        }
+        return result;
+    }
+};
+
+// HOT RELOAD - RESULTS DECODED BY THE WATCHER THREAD, WAITING TO BE SWAPPED IN
+struct PendingReload {
+    std::map<std::string, sf::Image> images;
+    std::map<std::string, sf::Font> fonts;
+    std::optional<std::vector<Question>> questions;
+    std::optional<QuestionIndex> index;
+};
+
+// HOT RELOAD - INOTIFY WATCHER ON THE ASSET FOLDER (NO-OP OUTSIDE LINUX)
+struct AssetWatcher {
+    std::string directory;
+    std::set<std::string> files;
+    std::vector<std::string> fontPaths;
+    std::u32string charset;
+    std::atomic<bool> running{ false };
+    std::thread worker;
+    std::mutex pendingMutex;
+    PendingReload pending;
+    bool hasPending = false;
+    int fd = -1;
+
+    AssetWatcher(const std::string& dir, const std::set<std::string>& watched,
+        const std::vector<std::string>& fonts, const std::u32string& chars)
+        : directory(dir), files(watched), fontPaths(fonts), charset(chars) {}
+
+    ~AssetWatcher() { stop(); }
+
+    bool start() {
+#ifdef __linux__
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) return false;
+        if (inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+            close(fd);
+            fd = -1;
+            return false;
+        }
+        running = true;
+        worker = std::thread(&AssetWatcher::run, this);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void stop() {
+        running = false;
+        if (worker.joinable()) worker.join();
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+        fd = -1;
+    }
+
+    // MAIN THREAD - TAKE EVERYTHING LOADED SO FAR, NEVER WAITS ON A LOAD IN PROGRESS
+    bool takePending(PendingReload& out) {
+        std::unique_lock<std::mutex> lock(pendingMutex, std::try_to_lock);
+        if (!lock.owns_lock() || !hasPending) return false;
+        out = std::move(pending);
+        pending = PendingReload();
+        hasPending = false;
+        return true;
+    }
+
+    // WORKER THREAD - COLLECT CHANGED NAMES, LOAD THEM ONCE WRITES SETTLE
+    void run() {
+#ifdef __linux__
+        alignas(inotify_event) char buffer[4096];
+        std::set<std::string> changed;
+        while (running) {
+            pollfd pfd{ fd, POLLIN, 0 };
+            if (poll(&pfd, 1, 100) > 0) {
+                ssize_t length = read(fd, buffer, sizeof(buffer));
+                for (char* p = buffer; length > 0 && p < buffer + length; ) {
+                    const inotify_event* ev = reinterpret_cast<const inotify_event*>(p);
+                    if (ev->len > 0 && files.count(ev->name)) changed.insert(ev->name);
+                    p += sizeof(inotify_event) + ev->len;
+                }
+                continue;
+            }
+            for (const std::string& name : changed) load(name);
+            changed.clear();
+        }
+#endif
+    }
+
+    void load(const std::string& name) {
+        std::string path = directory + "/" + name;
+        PendingReload result;
+
+        if (path == questionFile) {
+            std::vector<Question> questions;
+            if (!loadQuestionFile(path, questions)) {
+                std::cerr << "Reload failed: " << path << "\n";
+                return;
+            }
+			// NEW TEXT MAY NEED NEW GLYPHS - PREWARM FRESH FONT COPIES HERE, SWAPPED IN WITH THE BANK
+            std::u32string bankCharset = collectCharset(questions, uiStrings);
+            for (const std::string& fontPath : fontPaths) {
+                sf::Font font;
+                if (!font.openFromFile(fontPath)) {
+                    std::cerr << "Reload failed: " << fontPath << "\n";
+                    return;
+                }
+                prewarmGlyphs(font, bankCharset, textSizes);
+                result.fonts.emplace(fontPath, std::move(font));
+            }
+            result.index.emplace();
+            result.index->build(questions);
+            result.questions = std::move(questions);
+
+			// ONLY A FULLY LOADED BANK CHANGES WHAT LATER FONT RELOADS PREWARM
+            charset = std::move(bankCharset);
+        }
+        else if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ttf") == 0) {
+            sf::Font font;
+            if (!font.openFromFile(path)) {
+                std::cerr << "Reload failed: " << path << "\n";
+                return;
+            }
+            prewarmGlyphs(font, charset, textSizes);
+            result.fonts.emplace(path, std::move(font));
+        }
+        else {
+            sf::Image image;
+            if (!image.loadFromFile(path)) {
+                std::cerr << "Reload failed: " << path << "\n";
+                return;
+            }
+            result.images.emplace(path, std::move(image));
+        }
+
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        for (auto& [key, image] : result.images) pending.images[key] = std::move(image);
+        for (auto& [key, font] : result.fonts) pending.fonts[key] = std::move(font);
+        if (result.questions) {
+            pending.questions = std::move(result.questions);
+            pending.index = std::move(result.index);
+        }
+        hasPending = true;
+        std::cout << "Reloaded " << path << "\n";
+    }
+};
+
+// LOGIC PUZZLE GENERATOR - ORDERING PUZZLES ("Ana is taller than Ben.") WITH ONE ANSWER
+struct OrderingTheme {
+    std::string comparative;
+    std::string least;
+    std::string most;
+};
+const std::vector<OrderingTheme> orderingThemes = {
+    { "taller", "shortest", "tallest" },
+    { "older", "youngest", "oldest" },
+    { "faster", "slowest", "fastest" },
+    { "heavier", "lightest", "heaviest" },
+    { "richer", "poorest", "richest" }
+};
+const std::vector<std::string> puzzleNames = { "Ana", "Ben", "Cara", "Dan", "Eli", "Faye", "Gus", "Hana" };
+const int puzzlePeople = 4;
+const std::size_t puzzleMaxFacts = 4;
+
+// ONE FACT: PERSON "greater" RANKS ABOVE PERSON "lesser"
+struct Relation {
+    int greater;
+    int lesser;
+};
+
+// CONSTRAINT SOLVER - TRIES EVERY RANKING CONSISTENT WITH THE FACTS,
+// RETURNS THE PERSON WHO IS ALWAYS LEAST (OR MOST), -1 IF THAT IS NOT UNIQUE
+int solveOrdering(int people, const std::vector<Relation>& facts, bool askMost) {
+    std::vector<int> rank(people);
+    std::iota(rank.begin(), rank.end(), 0);
+    int answer = -1;
+    do {
+        bool consistent = true;
+        for (const Relation& r : facts)
+            if (rank[r.greater] < rank[r.lesser]) { consistent = false; break; }
+        if (!consistent) continue;
+
+        int target = askMost ? people - 1 : 0;
+        int who = static_cast<int>(std::find(rank.begin(), rank.end(), target) - rank.begin());
+        if (answer == -1) answer = who;
+        else if (answer != who) return -1;
+    } while (std::next_permutation(rank.begin(), rank.end()));
+    return answer;
+}
+
+// BUILD ONE PUZZLE: RANDOM HIDDEN RANKING, ADD TRUE FACTS UNTIL THE ANSWER IS UNIQUE
+Question generateOrderingPuzzle(std::mt19937& rng, long* solverCalls = nullptr) {
+    while (true) {
+        const OrderingTheme& theme = orderingThemes[rng() % orderingThemes.size()];
+        std::vector<std::string> names = puzzleNames;
+        std::shuffle(names.begin(), names.end(), rng);
+        names.resize(puzzlePeople);
+
+        std::vector<int> hidden(puzzlePeople);
+        std::iota(hidden.begin(), hidden.end(), 0);
+        std::shuffle(hidden.begin(), hidden.end(), rng);
+
+        std::vector<Relation> candidates;
+        for (int a = 0; a < puzzlePeople; a++)
+            for (int b = 0; b < puzzlePeople; b++)
+                if (hidden[a] > hidden[b]) candidates.push_back({ a, b });
+        std::shuffle(candidates.begin(), candidates.end(), rng);
+
+        bool askMost = rng() % 2 == 0;
+        std::vector<Relation> facts;
+        int answer = -1;
+        for (const Relation& r : candidates) {
+            facts.push_back(r);
+            if (solverCalls) (*solverCalls)++;
+            answer = solveOrdering(puzzlePeople, facts, askMost);
+            if (answer != -1 || facts.size() >= puzzleMaxFacts) break;
+        }
+        if (answer == -1) continue;
+
+		// LAYOUT LIKE THE HAND-WRITTEN RIDDLES: LEADING BLANK LINES, FIXED INDENT, LINES CENTERED WITH SPACES
+        const std::size_t puzzleIndent = 8;
+        std::vector<std::string> lines;
+        for (const Relation& r : facts)
+            lines.push_back(names[r.greater] + " is " + theme.comparative + " than " + names[r.lesser] + ".");
+        std::string query = "Who is the " + (askMost ? theme.most : theme.least) + "?";
+        std::size_t widest = query.size();
+        for (const std::string& line : lines) widest = std::max(widest, line.size());
+
+        Question q;
+        q.text = facts.size() > 3 ? "\n" : "\n\n";
+        for (const std::string& line : lines)
+            q.text += std::string(puzzleIndent + (widest - line.size()) / 2, ' ') + line + "\n";
+        q.text += "\n" + std::string(puzzleIndent + (widest - query.size()) / 2, ' ') + query;
+        q.answers = names;
+        q.correctIndex = answer;
+        return q;
+    }
+}
+
+// BACKGROUND PUZZLE QUEUE - KEEPS "capacity" PUZZLES READY SO THE QUIZ NEVER WAITS
+struct PuzzleQueue {
+    std::deque<Question> ready;
+    std::size_t capacity;
+    bool running = false;
+    std::thread worker;
+    std::mutex queueMutex;
+    std::condition_variable wake;
+
+    PuzzleQueue(std::size_t cap) : capacity(cap) {}
+
+    ~PuzzleQueue() { stop(); }
+
+    void start() {
+        running = true;
+        worker = std::thread(&PuzzleQueue::run, this);
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            running = false;
+        }
+        wake.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    bool tryPop(Question& out) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (ready.empty()) return false;
+        out = std::move(ready.front());
+        ready.pop_front();
+        wake.notify_one();
+        return true;
+    }
+
+    void run() {
+        std::mt19937 rng(std::random_device{}());
+        std::unique_lock<std::mutex> lock(queueMutex);
+        while (true) {
+            wake.wait(lock, [this]() { return !running || ready.size() < capacity; });
+            if (!running) break;
+            lock.unlock();
+            Question q = generateOrderingPuzzle(rng);
+            lock.lock();
+            ready.push_back(std::move(q));
+        }
+    }
+};
+
+// BACKGROUND SEARCH - ONLY THE LATEST QUERY MATTERS, THE BROWSER PICKS UP RESULTS WHEN READY
+struct SearchWorker {
+    std::shared_ptr<const QuestionIndex> index;
+    std::string query;
+    bool requested = false;
+    std::vector<int> results;
+    float resultMs = 0.f;
+    bool ready = false;
+    bool running = false;
+    std::thread worker;
+    std::mutex searchMutex;
+    std::condition_variable wake;
+
+    ~SearchWorker() { stop(); }
+
+    void start() {
+        running = true;
+        worker = std::thread(&SearchWorker::run, this);
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(searchMutex);
+            running = false;
+        }
+        wake.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    // REPLACES ANY QUERY NOT STARTED YET, RESULTS OF OLDER QUERIES ARE DROPPED
+    void request(const std::shared_ptr<const QuestionIndex>& idx, const std::string& q) {
+        {
+            std::lock_guard<std::mutex> lock(searchMutex);
+            index = idx;
+            query = q;
+            requested = true;
+            ready = false;
+        }
+        wake.notify_one();
+    }
+
+    bool takeResults(std::vector<int>& out, float& ms) {
+        std::lock_guard<std::mutex> lock(searchMutex);
+        if (!ready) return false;
+        out = std::move(results);
+        ms = resultMs;
+        ready = false;
+        return true;
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(searchMutex);
+        while (true) {
+            wake.wait(lock, [this]() { return !running || requested; });
+            if (!running) break;
+            std::shared_ptr<const QuestionIndex> idx = index;
+            std::string q = query;
+            requested = false;
+            lock.unlock();
+
+            sf::Clock clock;
+            std::vector<int> found = idx->search(q);
+            float ms = clock.getElapsedTime().asSeconds() * 1000.f;
+
+            lock.lock();
+            if (!requested) {
+                results = std::move(found);
+                resultMs = ms;
+                ready = true;
+            }
+        }
+    }
+};
+
+// PUZZLE BENCHMARK - RUN THE GAME WITH --bench-puzzles
+void benchmarkPuzzles() {
+    std::mt19937 rng(12345);
+    const int puzzleCount = 20000;
+    long solverCalls = 0;
+    sf::Clock clock;
+    for (int i = 0; i < puzzleCount; i++) generateOrderingPuzzle(rng, &solverCalls);
+    float generateSeconds = clock.restart().asSeconds();
+
+    const int solveCount = 200000;
+    std::vector<Relation> facts = { { 3, 2 }, { 2, 1 }, { 1, 0 } };
+    int sink = 0;
+    clock.restart();
+    for (int i = 0; i < solveCount; i++) sink += solveOrdering(puzzlePeople, facts, i % 2 == 0);
+    float solveSeconds = clock.restart().asSeconds();
+
+    std::cout << "Generated " << puzzleCount << " puzzles in " << generateSeconds << " s ("
+        << puzzleCount / generateSeconds << " puzzles/s, "
+        << static_cast<float>(solverCalls) / puzzleCount << " uniqueness checks per puzzle)\n";
+    std::cout << "Uniqueness check: " << solveSeconds * 1e6f / solveCount << " us each ("
+        << puzzlePeople << " people, " << facts.size() << " facts, checksum " << sink << ")\n";
+}
+
+// AUDIO - MONO 16-BIT EFFECTS MIXED IN SOFTWARE FROM A FIXED VOICE POOL
+const unsigned int audioRate = 44100;
+const std::size_t audioChunkFrames = 256;     // ~5.8 MS PER CHUNK HANDED TO THE DEVICE
+const int voiceCount = 8;
+
+struct Voice {
+    const std::int16_t* samples = nullptr;
+    std::size_t length = 0;
+    std::size_t position = 0;
+    std::uint64_t started = 0;
+    float volume = 1.f;
+    bool active = false;
+};
+
+// MIXER - PLAY() ONLY CLAIMS A VOICE, RENDER() WRITES INTO ANY CALLER-OWNED BUFFER
+struct SoundMixer {
+    std::array<Voice, voiceCount> voices;
+    std::uint64_t triggers = 0;
+    int stolen = 0;
+    std::mutex voiceMutex;
+
+    // RETURNS THE VOICE USED, THE OLDEST PLAYING VOICE IS STOLEN WHEN ALL ARE BUSY
+    int play(const std::int16_t* samples, std::size_t length, float volume = 1.f) {
+        std::lock_guard<std::mutex> lock(voiceMutex);
+        int chosen = -1;
+        for (int i = 0; i < voiceCount && chosen < 0; i++)
+            if (!voices[i].active) chosen = i;
+        if (chosen < 0) {
+            chosen = 0;
+            for (int i = 1; i < voiceCount; i++)
+                if (voices[i].started < voices[chosen].started) chosen = i;
+            stolen++;
+        }
+
+        Voice& v = voices[chosen];
+        v.samples = samples;
+        v.length = length;
+        v.position = 0;
+        v.started = ++triggers;
+        v.volume = volume;
+        v.active = length > 0;
+        return chosen;
+    }
+
+    int play(const sf::SoundBuffer& buffer, float volume = 1.f) {
+        return play(buffer.getSamples(), static_cast<std::size_t>(buffer.getSampleCount()), volume);
+    }
+
+    int activeVoices() {
+        std::lock_guard<std::mutex> lock(voiceMutex);
+        int count = 0;
+        for (const Voice& v : voices) count += v.active ? 1 : 0;
+        return count;
+    }
+
+    void render(std::int16_t* out, std::size_t frames) {
+        std::lock_guard<std::mutex> lock(voiceMutex);
+        for (std::size_t f = 0; f < frames; f++) {
+            float sum = 0.f;
+            for (Voice& v : voices) {
+                if (!v.active) continue;
+                sum += v.samples[v.position++] * v.volume;
+                if (v.position >= v.length) v.active = false;
+            }
+            out[f] = static_cast<std::int16_t>(std::clamp(sum, -32768.f, 32767.f));
+        }
+    }
+};
+
+// DEVICE OUTPUT - SFML PULLS SMALL CHUNKS FROM THE MIXER ON ITS AUDIO THREAD
+struct MixerStream : sf::SoundStream {
+    SoundMixer& mixer;
+    std::array<std::int16_t, audioChunkFrames> chunk{};
+
+    MixerStream(SoundMixer& m) : mixer(m) {
+        initialize(1, audioRate, { sf::SoundChannel::Mono });
+    }
+
+    ~MixerStream() override { stop(); }
+
+    bool onGetData(Chunk& data) override {
+        mixer.render(chunk.data(), chunk.size());
+        data.samples = chunk.data();
+        data.sampleCount = chunk.size();
+        return true;
+    }
+
+    void onSeek(sf::Time) override {}
+};
+
+// EFFECT SYNTHESIS - NOTES PLAYED ONE AFTER ANOTHER WITH A DECAYING ENVELOPE
+std::vector<std::int16_t> synthEffect(const std::vector<float>& notes, float noteSeconds, float amplitude, bool square) {
+    const float pi = 3.14159265f;
+    std::size_t noteFrames = static_cast<std::size_t>(noteSeconds * audioRate);
+    std::vector<std::int16_t> samples;
+    samples.reserve(noteFrames * notes.size());
+    for (float freq : notes) {
+        for (std::size_t i = 0; i < noteFrames; i++) {
+            float wave = std::sin(2.f * pi * freq * i / audioRate);
+            if (square) wave = wave >= 0.f ? 1.f : -1.f;
+            float envelope = 1.f - static_cast<float>(i) / noteFrames;
+            samples.push_back(static_cast<std::int16_t>(wave * envelope * amplitude * 32767.f));
+        }
+    }
+    return samples;
+}
+
+bool loadEffect(sf::SoundBuffer& buffer, const std::vector<std::int16_t>& samples) {
+    return buffer.loadFromSamples(samples.data(), samples.size(), 1, audioRate, { sf::SoundChannel::Mono });
+}
+
+// OFFLINE MIXER TESTS - RUN THE GAME WITH --test-audio (NO AUDIO DEVICE NEEDED)
+int testAudioMixer() {
+    int failures = 0;
+    auto check = [&failures](bool ok, const std::string& name) {
+        std::cout << (ok ? "PASS " : "FAIL ") << name << "\n";
+        if (!ok) failures++;
+        };
+
+    std::vector<std::int16_t> beep = synthEffect({ 880.f }, 0.05f, 0.5f, true);
+    std::vector<std::int16_t> loud(audioRate, 32767);
+    std::array<std::int16_t, audioChunkFrames> out{};
+
+    // TRIGGER-TO-MIX DELAY - A SOUND TRIGGERED BETWEEN CHUNKS IS MIXED FROM THE FIRST FRAME OF THE NEXT ONE
+    // (MIXER ONLY, THE DEVICE BUFFERING INSIDE SF::SOUNDSTREAM IS NOT MEASURED HERE)
+    SoundMixer mixer;
+    mixer.render(out.data(), out.size());
+    mixer.play(beep.data(), beep.size());
+    mixer.render(out.data(), out.size());
+    std::size_t firstFrame = 0;
+    while (firstFrame < out.size() && out[firstFrame] == 0) firstFrame++;
+    check(firstFrame == 0, "mixer starts a trigger on the first frame of the next chunk (trigger-to-mix delay <= "
+        + std::to_string(audioChunkFrames) + " frames, device buffering excluded)");
+
+    // VOICES FREE THEMSELVES WHEN THEIR SAMPLES RUN OUT
+    for (std::size_t rendered = out.size(); rendered < beep.size(); rendered += out.size())
+        mixer.render(out.data(), out.size());
+    check(mixer.activeVoices() == 0, "finished voice is released");
+
+    // VOICE STEALING - ONE TRIGGER PAST THE POOL SIZE REPLACES THE OLDEST VOICE
+    SoundMixer busy;
+    std::vector<int> used;
+    for (int i = 0; i < voiceCount; i++) used.push_back(busy.play(loud.data(), loud.size(), 0.1f));
+    busy.render(out.data(), out.size());
+    std::array<Voice, voiceCount> before = busy.voices;
+    int replaced = busy.play(beep.data(), beep.size());
+    check(busy.stolen == 1 && replaced == used[0], "oldest voice is stolen when the pool is full");
+
+    const Voice& restarted = busy.voices[replaced];
+    check(restarted.active && restarted.samples == beep.data() && restarted.length == beep.size() &&
+        restarted.position == 0, "stolen voice plays the new effect from its first sample");
+
+    bool othersUntouched = true;
+    for (int i = 0; i < voiceCount; i++) {
+        if (i == replaced) continue;
+        const Voice& v = busy.voices[i];
+        othersUntouched = othersUntouched && v.active && v.samples == before[i].samples &&
+            v.position == before[i].position && v.started == before[i].started;
+    }
+    check(othersUntouched, "the other " + std::to_string(voiceCount - 1) + " voices keep playing untouched");
+
+    // CLIPPING - A FULL POOL AT FULL SCALE SATURATES INSTEAD OF WRAPPING
+    SoundMixer clip;
+    for (int i = 0; i < voiceCount; i++) clip.play(loud.data(), loud.size());
+    clip.render(out.data(), out.size());
+    check(std::all_of(out.begin(), out.end(), [](std::int16_t s) { return s == 32767; }), "mix saturates at full scale");
+
+    std::cout << (failures == 0 ? "All audio tests passed\n" : "Audio tests failed\n");
+    return failures == 0 ? 0 : 1;
+}
+
+// GLYPH PAGE CHECK - LAYS OUT EVERY QUIZ STRING ON FRESH FONTS PREWARMED WITH "warmed"
+// AND RETURNS HOW MANY GLYPH PAGES HAD PIXELS DRAWN DURING LAYOUT (-1 IF A FONT FAILED TO OPEN)
+int changedGlyphPages(const std::vector<Question>& questions, const std::u32string& warmed, float& worstFrame) {
+    sf::Font lilitaFont, lilexFont;
+    if (!lilitaFont.openFromFile("assets/LilitaOne-Regular.ttf") ||
+        !lilexFont.openFromFile("assets/Lilex-SemiBold.ttf"))
+        return -1;
+    prewarmGlyphs(lilitaFont, warmed, textSizes);
+    prewarmGlyphs(lilexFont, warmed, textSizes);
+
+    // NEW GLYPHS USUALLY LAND IN FREE SPACE ON A PAGE, SO COMPARE PIXELS, NOT JUST PAGE SIZES
+    std::vector<std::pair<const sf::Font*, unsigned int>> pages;
+    std::vector<sf::Image> snapshots;
+    for (const sf::Font* font : { &lilitaFont, &lilexFont }) {
+        for (unsigned int size : textSizes) {
+            pages.push_back({ font, size });
+            snapshots.push_back(font->getTexture(size).copyToImage());
+        }
+    }
+
+    // ONE LAYOUT FRAME = EVERY STRING ONE QUIZ FRAME DRAWS, WITH THE SAME FONT AND SIZE
+    sf::Clock clock;
+    for (std::size_t i = 0; i < questions.size(); i++) {
+        clock.restart();
+        sf::Text qText(lilitaFont, toSfString(questions[i].text), 50);
+        qText.getLocalBounds();
+        for (const std::string& answer : questions[i].answers) {
+            sf::Text aText(lilitaFont, toSfString(answer), 35);
+            aText.getLocalBounds();
+        }
+        int seconds = static_cast<int>(i % 181);
+        sf::Text timerText(lilexFont, "0" + std::to_string(seconds / 60) + ":" +
+            (seconds % 60 < 10 ? "0" : "") + std::to_string(seconds % 60), 60);
+        timerText.getLocalBounds();
+        sf::Text completeText(lilitaFont, "You scored " + std::to_string(i) + " points", 45);
+        completeText.getLocalBounds();
+        worstFrame = std::max(worstFrame, clock.getElapsedTime().asSeconds());
+    }
+
+    int changed = 0;
+    for (std::size_t p = 0; p < pages.size(); p++) {
+        sf::Image now = pages[p].first->getTexture(pages[p].second).copyToImage();
+        sf::Vector2u size = now.getSize(), oldSize = snapshots[p].getSize();
+        bool same = size.x == oldSize.x && size.y == oldSize.y &&
+            std::equal(now.getPixelsPtr(), now.getPixelsPtr() + std::size_t(size.x) * size.y * 4,
+                snapshots[p].getPixelsPtr());
+        if (!same) changed++;
+    }
+    return changed;
+}
+
+// GLYPH PREWARM TEST - RUN THE GAME WITH --test-glyphs
+// AFTER PREWARMING, LAYING OUT EVERY QUIZ STRING MUST NOT DRAW INTO ANY GLYPH PAGE
+int testGlyphs() {
+    std::vector<Question> questions;
+    if (!loadQuestionFile(questionFile, questions)) {
+        std::cout << "FAIL question bank failed to load\n";
+        return 1;
+    }
+
+    int failures = 0;
+    auto check = [&failures](bool ok, const std::string& name) {
+        std::cout << (ok ? "PASS " : "FAIL ") << name << "\n";
+        if (!ok) failures++;
+        };
+
+    const float frameBudget = 1.f / 60.f;
+    float worstFrame = 0.f;
+    std::u32string charset = collectCharset(questions, uiStrings);
+    int changed = changedGlyphPages(questions, charset, worstFrame);
+    check(changed >= 0, "fonts open");
+    check(changed == 0, "no glyph page is drawn into during layout (" + std::to_string(changed) + " changed)");
+    check(worstFrame <= frameBudget, "slowest layout frame " + std::to_string(worstFrame * 1000.f) + " ms fits a 60 FPS frame");
+
+    // CONTROL - WITH THE QUESTION TEXT LEFT OUT OF THE CHARSET, THE SAME CHECK MUST CATCH THE NEW GLYPHS
+    std::u32string uiOnly = collectCharset({}, uiStrings);
+    if (uiOnly != charset) {
+        float controlFrame = 0.f;
+        int controlChanged = changedGlyphPages(questions, uiOnly, controlFrame);
+        check(controlChanged > 0, "control: glyphs left out of the prewarm are detected ("
+            + std::to_string(controlChanged) + " pages changed)");
+    }
+    else std::cout << "SKIP control: question bank uses no characters outside the UI strings\n";
+
+    std::cout << (failures == 0 ? "All glyph tests passed\n" : "Glyph tests failed\n");
+    return failures == 0 ? 0 : 1;
+}
+
 // MAIN FUNCTION
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench-puzzles") {
+        benchmarkPuzzles();
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--test-audio") return testAudioMixer();
+    if (argc > 1 && std::string(argv[1]) == "--test-glyphs") return testGlyphs();
+
     sf::RenderWindow window(sf::VideoMode({ 1500, 900 }), "LOGIQ v1.0.0 - SFML 3.0.2");
     window.setFramerateLimit(60);
 
@@ -101,30 +1057,34 @@ int main() {
     sf::Texture texQuestionBG, texA1, texA2, texA3, texA4;
 	sf::Texture texComplete, texTryAgain, texExit;
 
-	// LOADING ASSETS - ENSURE ALL FILE EXIST
-    if (!texTitle.loadFromFile("assets/titleLOGIQ.png") ||
-        !texHomePage.loadFromFile("assets/homepage.png") ||
-        !texbtnStart.loadFromFile("assets/btnStart.png") ||
-        !texbtnCredits.loadFromFile("assets/btnCredits.png") ||
-        !texbtnHelp.loadFromFile("assets/btnHelp.png") ||
-        !texCreditsPage.loadFromFile("assets/creditsPage.png") ||
-        !texHelpPage.loadFromFile("assets/helpPage.png") ||
-        !texChoose.loadFromFile("assets/timeSelectionPage.png") ||
-        !tex1m.loadFromFile("assets/btn1min.png") ||
-        !tex2m.loadFromFile("assets/btn2mins.png") ||
-        !tex3m.loadFromFile("assets/btn3mins.png") ||
-        !texBack.loadFromFile("assets/btnBack.png") ||
-        !texQuestionBG.loadFromFile("assets/questionPage.png") ||
-        !texA1.loadFromFile("assets/btnA1.png") ||
-        !texA2.loadFromFile("assets/btnA2.png") ||
-        !texA3.loadFromFile("assets/btnA3.png") ||
-        !texComplete.loadFromFile("assets/completePage.png") ||
-        !texTryAgain.loadFromFile("assets/btnTryAgain.png") ||
-        !texExit.loadFromFile("assets/btnExit.png") ||
-        !texA4.loadFromFile("assets/btnA4.png"))
-    {
-        std::cerr << "Asset loading failed\n";
-        return 1;
+	// LOADING ASSETS - ENSURE ALL FILE EXIST (PATH -> TEXTURE, ALSO USED BY HOT RELOAD)
+    std::map<std::string, sf::Texture*> textureFiles = {
+        { "assets/titleLOGIQ.png", &texTitle },
+        { "assets/homepage.png", &texHomePage },
+        { "assets/btnStart.png", &texbtnStart },
+        { "assets/btnCredits.png", &texbtnCredits },
+        { "assets/btnHelp.png", &texbtnHelp },
+        { "assets/creditsPage.png", &texCreditsPage },
+        { "assets/helpPage.png", &texHelpPage },
+        { "assets/timeSelectionPage.png", &texChoose },
+        { "assets/btn1min.png", &tex1m },
+        { "assets/btn2mins.png", &tex2m },
+        { "assets/btn3mins.png", &tex3m },
+        { "assets/btnBack.png", &texBack },
+        { "assets/questionPage.png", &texQuestionBG },
+        { "assets/btnA1.png", &texA1 },
+        { "assets/btnA2.png", &texA2 },
+        { "assets/btnA3.png", &texA3 },
+        { "assets/completePage.png", &texComplete },
+        { "assets/btnTryAgain.png", &texTryAgain },
+        { "assets/btnExit.png", &texExit },
+        { "assets/btnA4.png", &texA4 }
+    };
+    for (auto& [path, texture] : textureFiles) {
+        if (!texture->loadFromFile(path)) {
+            std::cerr << "Asset loading failed\n";
+            return 1;
+        }
     }
 
 	// INITIALIZATION OF SPRITES 
@@ -216,139 +1176,93 @@ int main() {
     sf::Clock titleClock;
     bool titleArrived = false;
 
-	// RANDOMIZE QUIZ QUESTIONN
-    std::vector<Question> quizQuestions = {
-        {
-            "\n\n         A is taller than B.\n"
-            "          B is taller than C.\n\n"
-            "       Who is the shortest?",
-            {"A", "B", "C", "D"},
-            2
-        },
-        {
-            "\n\n        The more you take from me,\n"
-            "                   the bigger I get.\n\n"
-            "                       What am I?",
-            {"Puddle", "Pit", "Hole", "Ditch"},
-            2
-        },
-        {
-            "\n\n         I speak without a mouth,\n"
-            "                  hear without ears,\n"
-            "      and answer when spoken to.\n\n"
-            "                      What am I?",
-            {"An echo", "A ghost", "A shadow", "A thought"},
-            0
-        },
-        {
-            "\n\n\n         What can travel around the world\n"
-            "              while staying in a corner?",
-            {"Globe", "Plane", "Compass", "Stamp"},
-            3
-        },
-        {
-            "\n\n       You see a boat filled with people,\n"
-            "                   yet there isn’t a single \n                         person on board.\n\n"
-            "                  How is that possible?",
-            {"They're married", "They're invisible", "He jumped off", "A ghost ship"},
-            0
-        },
-        {
-            "\n\n    I’m tall when I’m young\n"
-            "    and short when I’m old.\n\n"
-            "                 What am I?",
-            {"Chalk", "Pencil", "Candle", "Matchstick"},
-            2
-        },
-        {
-            "\n            It belongs to you,\n"
-            "       but other people use \n          it more than you do.\n\n"
-            "                What is it?",
-            {"Your ID", "Your name", "Pen", "Comb"},
-            1
-        },
-        {
-            "\n\n     What starts with T,\n"
-            "             ends with T,\n"
-            "      and has T inside it?",
-            {"Tent", "Teacup", "Ticket", "Teapot"},
-            3
-        },
-        {
-            "\n\n\n         What goes away as soon \n      as you talk about it?",
-            {"Noise", "Silence", "Secret", "Shadow"},
-            1
-        },
-        {
-            "\n\n         What can run but never walks,\n"
-            "         has a mouth but never talks,\n"
-            "         has a head but never weeps,\n"
-            "         has a bed but never sleeps?",
-            {"Clock", "Train", "River", "Road"},
-            2
-        },
-        {
-            "\n\n\n\n         What has hands but can’t clap?",
-            {"Robot", "Clock", "Statue", "Mannequin"},
-            1
-        },
-        {
-            "\n         A is the brother of B.\n"
-            "         B is the brother of C.\n"
-            "         C is the father of D.\n\n"
-            "        How is D related to A?",
-            {"Niece", "Child", "Uncle", "Cousin"},
-            0
-        },
-        {
-            "\n\n         I can fall off a building and live,\n"
-            "         but put me in water and I will die.\n\n"
-            "                         What am I?",
-            {"Candle", "Paper", "Leaf", "Feather"},
-            1
-        },
-        {
-            "\n\n         I have a face but no eyes,\n"
-            "         hands but no arms.\n\n"
-            "                 What am I?",
-            {"Doll", "Clock", "Mirror", "Mask"},
-            1
-        },
-        {
-            "\n\n\n         What falls but never breaks,\n"
-            "         and breaks but never falls?",
-            {"Day & night", "Dawn & dusk", "Rain & hail", "Snow & ice"},
-            0
-        },
-        {
-            "\n\n         I’m not a teacher,\n"
-            "      but I help you write.\n\n"
-            "                What am I?",
-            {"Sister", "Book", "Parents", "Pencil"},
-            3
-        },
-        {
-            "\n\n\n         What can go up a chimney down,\n"
-            "         but can’t go down a chimney up?",
-            {"Umbrella", "Person", "Balloon", "Hat"},
-            0
-        },
-        {
-            "\n\n             I can fill a room,\n"
-            "         but I take up no space.\n\n"
-            "                      What am I?",
-            {"Water", "Air", "Light", "Fire"},
-            2
-        },
-        {
-            "\n\n\n         I’m always in front of you\n"
-            "             but can’t be seen.\n\n"
-            "                   What am I?",
-            {"Future", "Nose", "Eyelashes", "Human"},
-            0
-        },
+	// SPRITES PER TEXTURE - HOT RELOAD RESIZES THEM WHEN AN EDITED PNG CHANGES SIZE
+    struct SpriteBinding {
+        sf::Sprite* sprite;
+        const sf::Texture* texture;
+        bool centered;
+    };
+    std::vector<SpriteBinding> spriteBindings = {
+        { &home, &texHomePage, false },
+        { &titleLOGIQ, &texTitle, true },
+        { &btnStart, &texbtnStart, true },
+        { &btnHelp, &texbtnHelp, true },
+        { &btnCredits, &texbtnCredits, true },
+        { &creditsPage, &texCreditsPage, false },
+        { &helpPage, &texHelpPage, false },
+        { &chooseBG, &texChoose, false },
+        { &btn1min, &tex1m, false },
+        { &btn2mins, &tex2m, false },
+        { &btn3mins, &tex3m, false },
+        { &btnBack, &texBack, true },
+        { &questionBG, &texQuestionBG, false },
+        { &answerBtns[0], &texA1, true },
+        { &answerBtns[1], &texA2, true },
+        { &answerBtns[2], &texA3, true },
+        { &answerBtns[3], &texA4, true },
+        { &btnTryAgain, &texTryAgain, true },
+        { &btnExit, &texExit, true }
+    };
+
+	// LOAD QUESTION BANK (NEVER MODIFIED WHILE PLAYING, ONLY REPLACED BY HOT RELOAD)
+    std::vector<Question> questionBank;
+    if (!loadQuestionFile(questionFile, questionBank)) {
+        std::cerr << "Question bank failed to load\n";
+        return 1;
+    }
+
+	// SEARCH INDEX FOR THE QUESTION BROWSER
+    auto initialIndex = std::make_shared<QuestionIndex>();
+    initialIndex->build(questionBank);
+    std::shared_ptr<const QuestionIndex> questionIndex = initialIndex;
+
+	// PREWARM GLYPH PAGES FOR EVERY TEXT SIZE USED (TIMER 60, QUESTION 50, SCORE 45, ANSWERS 35)
+    std::u32string charset = collectCharset(questionBank, uiStrings);
+    prewarmGlyphs(lilitaFont, charset, textSizes);
+    prewarmGlyphs(lilexFont, charset, textSizes);
 
+	// HOT RELOAD WATCHER - RELOADS CHANGED TEXTURES, FONTS AND QUESTION FILE IN THE BACKGROUND
+    std::map<std::string, sf::Font*> fontFiles = {
+        { "assets/LilitaOne-Regular.ttf", &lilitaFont },
+        { "assets/Lilex-SemiBold.ttf", &lilexFont }
     };
+    std::set<std::string> watchedFiles = { questionFile.substr(assetDir.size() + 1) };
+    for (auto& [path, texture] : textureFiles) watchedFiles.insert(path.substr(assetDir.size() + 1));
+    std::vector<std::string> fontPaths;
+    for (auto& [path, font] : fontFiles) {
+        watchedFiles.insert(path.substr(assetDir.size() + 1));
+        fontPaths.push_back(path);
+    }
+
+    AssetWatcher assetWatcher(assetDir, watchedFiles, fontPaths, charset);
+    if (!assetWatcher.start()) std::cout << "Hot reload unavailable\n";
+    PendingReload reload;
+
+	// GENERATED LOGIC PUZZLES - SERVED ONCE THE QUESTION BANK RUNS OUT
+    PuzzleQueue puzzleQueue(32);
+    puzzleQueue.start();
+
+	// SOUND EFFECTS - SYNTHESIZED INTO SOUND BUFFERS ONCE, PLAYED FROM THE VOICE POOL
+    sf::SoundBuffer sfxCorrect, sfxWrong, sfxClick;
+    if (!loadEffect(sfxCorrect, synthEffect({ 660.f, 990.f }, 0.12f, 0.4f, false)) ||
+        !loadEffect(sfxWrong, synthEffect({ 150.f }, 0.3f, 0.25f, true)) ||
+        !loadEffect(sfxClick, synthEffect({ 1200.f }, 0.03f, 0.3f, false)))
+    {
+        std::cerr << "Sound effects failed to load\n";
+        return 1;
+    }
+    SoundMixer mixer;
+    MixerStream sfxStream(mixer);
+    sfxStream.play();
+
+	// BACKGROUND MUSIC - OPTIONAL, SF::MUSIC STREAMS IT ON ITS OWN THREAD
+    sf::Music music;
+    if (music.openFromFile("assets/music.ogg")) {
+        music.setLooping(true);
+        music.setVolume(40.f);
+        music.play();
+    }
+    else std::cout << "No background music (assets/music.ogg)\n";
 
 	// GAME LOOP VARIABLES
     int currentQuestion = 0;
@@ -356,7 +1270,116 @@ int main() {
     std::vector<int> answerOrder = { 0,1,2,3 };
     std::mt19937 rng(std::random_device{}());
 
+	// QUIZ ROUND - BANK IDS SHUFFLED LAZILY (ONE FISHER-YATES STEP PER QUESTION), PUZZLES KEPT ASIDE
+    std::vector<int> roundOrder(questionBank.size());
+    std::iota(roundOrder.begin(), roundOrder.end(), 0);
+    std::vector<Question> roundPuzzles;
+    auto roundSize = [&]() {
+        return static_cast<int>(roundOrder.size() + roundPuzzles.size());
+        };
+    auto roundQuestion = [&](int i) -> const Question& {
+        if (i < static_cast<int>(roundOrder.size())) return questionBank[roundOrder[i]];
+        return roundPuzzles[i - roundOrder.size()];
+        };
+    auto shuffleRoundSlot = [&](int i) {
+        if (i + 1 >= static_cast<int>(roundOrder.size())) return;
+        std::uniform_int_distribution<int> pick(i, static_cast<int>(roundOrder.size()) - 1);
+        std::swap(roundOrder[i], roundOrder[pick(rng)]);
+        };
+
+	// QUESTION BROWSER VARIABLES
+    std::string searchQuery;
+    std::vector<int> searchResults;
+    int searchSelected = 0;
+    float searchMs = 0.f;
+    bool searchPending = false;
+    SearchWorker searchWorker;
+    searchWorker.start();
+    const std::vector<int> browserOrder = { 0,1,2,3 };
+    sf::Text searchText(lilexFont);
+    searchText.setCharacterSize(35);
+    searchText.setFillColor(sf::Color(101, 67, 33));
+    searchText.setPosition({ 50.f, 40.f });
+
+    auto runSearch = [&]() {
+        searchWorker.request(questionIndex, searchQuery);
+        searchPending = true;
+        };
+
+	// QUESTION LAYOUT - SHARED BY THE QUIZ AND THE BROWSER PREVIEW
+    auto drawQuestion = [&](const Question& question, const std::vector<int>& order, int highlight) {
+        for (int i = 0; i < 4; i++)
+            window.draw(answerBtns[i]);
+
+		// SETTING QUESTION TEXT
+        sf::Text qText(lilitaFont);
+        qText.setString(toSfString(question.text));
+        qText.setCharacterSize(50);
+        qText.setFillColor(sf::Color::White);
+
+        sf::FloatRect bounds = qText.getLocalBounds();
+        qText.setOrigin({
+            bounds.position.x + bounds.size.x / 2.f,
+            bounds.position.y
+            });
+        qText.setPosition({ 750.f, 100.f });
+
+        window.draw(qText);
+        for (int i = 0; i < 4; i++) {
+
+            if (i >= static_cast<int>(question.answers.size())) continue;
+
+            sf::Text aText(lilitaFont);
+            aText.setString(toSfString(question.answers[order[i]]));
+            aText.setCharacterSize(35);
+            aText.setFillColor(order[i] == highlight ? sf::Color::Yellow : sf::Color::White);
+
+            aText.setPosition({
+                answerBtns[i].getPosition().x - aText.getLocalBounds().size.x / 1.f,
+                answerBtns[i].getPosition().y - aText.getLocalBounds().size.y / 2.f
+                });
+
+            window.draw(aText);
+        }
+        };
+
     while (window.isOpen()) {
+		// SWAP IN HOT RELOADED ASSETS BETWEEN FRAMES
+        if (assetWatcher.takePending(reload)) {
+            for (auto& [path, image] : reload.images) {
+                auto it = textureFiles.find(path);
+                if (it == textureFiles.end()) continue;
+                sf::Vector2u oldSize = it->second->getSize();
+                if (!it->second->loadFromImage(image)) {
+                    std::cerr << "Texture upload failed: " << path << "\n";
+                    continue;
+                }
+                sf::Vector2u newSize = it->second->getSize();
+                if (newSize.x == oldSize.x && newSize.y == oldSize.y) continue;
+                for (SpriteBinding& binding : spriteBindings) {
+                    if (binding.texture != it->second) continue;
+                    binding.sprite->setTextureRect(sf::IntRect({ 0, 0 }, sf::Vector2i(newSize)));
+                    if (binding.centered) centerOrigin(*binding.sprite);
+                }
+            }
+            for (auto& [path, font] : reload.fonts) {
+                auto it = fontFiles.find(path);
+                if (it != fontFiles.end()) *it->second = std::move(font);
+            }
+            if (reload.questions) {
+                questionBank = std::move(*reload.questions);
+                questionIndex = std::make_shared<const QuestionIndex>(std::move(*reload.index));
+                roundOrder.resize(questionBank.size());
+                std::iota(roundOrder.begin(), roundOrder.end(), 0);
+                roundPuzzles.clear();
+                currentQuestion = 0;
+                shuffleRoundSlot(0);
+                searchResults.clear();
+                runSearch();
+            }
+            reload = PendingReload();
+        }
+
         if (state == GameState::HOME) {
             updateHitbox(hitStart, btnStart);
             updateHitbox(hitHelp, btnHelp);
@@ -474,7 +1497,7 @@ int main() {
                             for (int i = 0; i < 4; i++) {
                                 if (answerHitboxes[i].contains(pos)) {
                                     int chosen = answerOrder[i];
-                                    int correct = quizQuestions[currentQuestion].correctIndex;
+                                    int correct = roundQuestion(currentQuestion).correctIndex;
                                     lastClickedAnswer = i;
                                     inputBlocked = true; 
 
@@ -488,8 +1511,9 @@ int main() {
 
                                     showFeedback = true;
                                     feedbackClock.restart();
+                                    mixer.play(chosen == correct ? sfxCorrect : sfxWrong);
 
-                                    if (chosen == quizQuestions[currentQuestion].correctIndex) {
+                                    if (chosen == roundQuestion(currentQuestion).correctIndex) {
                                         std::cout << "CORRECT +1\n";
                                         score++;
                                     }
@@ -497,7 +1521,7 @@ int main() {
                                         std::cout << "WRONG!\n";
                                     }
 
-                                    if (currentQuestion >= quizQuestions.size()) {
+                                    if (currentQuestion >= roundSize()) {
                                         nextState = GameState::COMPLETE;
                                         isFading = true;
                                         fadeOut = true;
@@ -513,11 +1537,45 @@ int main() {
                         }
 
                         if (nextState != state) {
+                            mixer.play(sfxClick);
                             isFading = true;
                             fadeOut = true;
                             fadeClock.restart();
                         }
                     }
+                }
+
+				// KEYBOARD - F2 ON THE HOMEPAGE OPENS THE QUESTION BROWSER
+                if (auto key = event->getIf<sf::Event::KeyPressed>()) {
+                    if (state == GameState::HOME && key->code == sf::Keyboard::Key::F2) {
+                        nextState = GameState::BROWSER;
+                        runSearch();
+                        mixer.play(sfxClick);
+                        isFading = true; fadeOut = true; fadeClock.restart();
+                    }
+                    else if (state == GameState::BROWSER) {
+                        if (key->code == sf::Keyboard::Key::Escape) {
+                            nextState = GameState::HOME;
+                            mixer.play(sfxClick);
+                            isFading = true; fadeOut = true; fadeClock.restart();
+                        }
+                        else if (key->code == sf::Keyboard::Key::Backspace && !searchQuery.empty()) {
+                            searchQuery.pop_back();
+                            runSearch();
+                        }
+                        else if (key->code == sf::Keyboard::Key::Down && searchSelected + 1 < static_cast<int>(searchResults.size()))
+                            searchSelected++;
+                        else if (key->code == sf::Keyboard::Key::Up && searchSelected > 0)
+                            searchSelected--;
+                    }
+                }
+
+				// TYPING IN THE BROWSER SEARCH BAR
+                if (auto typed = event->getIf<sf::Event::TextEntered>()) {
+                    if (state == GameState::BROWSER && typed->unicode >= 32 && typed->unicode < 127) {
+                        searchQuery += static_cast<char>(typed->unicode);
+                        runSearch();
+                    }
                 }
             }
         }
@@ -553,9 +1611,10 @@ int main() {
 
 			// SHUFFLE PART OF QUESTION LOGIC
             if (nextState == GameState::QUIZ && state != GameState::QUIZ) {
-                std::shuffle(quizQuestions.begin(), quizQuestions.end(), rng);
+                roundPuzzles.clear();
                 std::shuffle(answerOrder.begin(), answerOrder.end(), rng);
                 currentQuestion = 0;
+                shuffleRoundSlot(0);
             }
 
             state = nextState; fadeOut = false; }
@@ -638,46 +1697,8 @@ int main() {
             window.draw(timerText);
             
   
-            if (currentQuestion < quizQuestions.size()) {
-                for (int i = 0; i < 4; i++)
-                    window.draw(answerBtns[i]);
-
-				// SETTING QUESTION TEXT
-                sf::Text qText(lilitaFont);
-                qText.setString(quizQuestions[currentQuestion].text);
-                qText.setCharacterSize(50);
-                qText.setFillColor(sf::Color::White);
-
-                sf::FloatRect bounds = qText.getLocalBounds();
-                qText.setOrigin({
-                    bounds.position.x + bounds.size.x / 2.f,
-                    bounds.position.y
-                    });
-                qText.setPosition({ 750.f, 100.f });
-
-                window.draw(qText);
-                for (int i = 0; i < 4; i++) {
- 
-                    if (i >= quizQuestions[currentQuestion].answers.size()) continue;
-
-                    sf::Text aText(lilitaFont);
-                    aText.setString(quizQuestions[currentQuestion].answers[answerOrder[i]]);
-                    aText.setCharacterSize(35);
-                    aText.setFillColor(sf::Color::White);
-
-                    sf::FloatRect btnBounds = answerBtns[i].getGlobalBounds();
-                    sf::FloatRect textBounds = aText.getLocalBounds();
-
-
-                    aText.setPosition({
-    answerBtns[i].getPosition().x - aText.getLocalBounds().size.x / 1.f,
-    answerBtns[i].getPosition().y - aText.getLocalBounds().size.y / 2.f
-                        });
-
-                    window.draw(aText);
-                }
-
-            }
+            if (currentQuestion < roundSize())
+                drawQuestion(roundQuestion(currentQuestion), answerOrder, -1);
         }
         
         // DRAW FEEDBACK FULL SCREEN GREEN/RED OVERLAYY
@@ -694,8 +1715,14 @@ int main() {
                 lastClickedAnswer = -1; 
                 inputBlocked = false;
                 currentQuestion++; 
+                shuffleRoundSlot(currentQuestion);
 
-                if (currentQuestion >= quizQuestions.size()) {
+				// BANK USED UP - CONTINUE WITH A PREGENERATED LOGIC PUZZLE
+                Question puzzle;
+                if (currentQuestion >= roundSize() && puzzleQueue.tryPop(puzzle))
+                    roundPuzzles.push_back(std::move(puzzle));
+
+                if (currentQuestion >= roundSize()) {
                     nextState = GameState::COMPLETE;
                     isFading = true;
                     fadeOut = true;
@@ -741,6 +1768,29 @@ int main() {
             window.draw(helpPage);
             window.draw(btnBack);
         }
+        else if (state == GameState::BROWSER) {
+            window.draw(questionBG);
+
+			// PICK UP FINISHED SEARCHES, THE FRAME NEVER WAITS ON ONE
+            if (searchWorker.takeResults(searchResults, searchMs)) {
+                searchPending = false;
+                searchSelected = 0;
+            }
+
+			// SEARCH BAR AND RESULT COUNT, CORRECT ANSWER SHOWN IN YELLOW
+            std::string status = searchPending ? "searching" : searchResults.empty() ? "no results" :
+                std::to_string(searchSelected + 1) + "/" + std::to_string(searchResults.size());
+            char timing[32];
+            std::snprintf(timing, sizeof(timing), "%.2f ms", searchMs);
+            searchText.setString(toSfString("Search: " + searchQuery + "_   " + status + " (" + timing + ")"));
+            window.draw(searchText);
+
+            if (!searchResults.empty() && searchResults[searchSelected] < static_cast<int>(questionBank.size())) {
+                const Question& preview = questionBank[searchResults[searchSelected]];
+                drawQuestion(preview, browserOrder, preview.correctIndex);
+            }
+            window.draw(btnBack);
+        }
 
         if (isFading) window.draw(fadeRect);
         window.display();